@@ -0,0 +1,141 @@
+#!/bin/sh
+#
+# Benchmark runner of ccdoc
+#
+# Runs ccdoc --stats several times on fixed corpora and takes the median of each
+# metric. The tiny and self corpora are frozen copies of sources in bench/corpus,
+# the large one is generated. 'record' writes the medians to the baseline file,
+# 'check' compares them with the baseline and fails if wall time, throughput or
+# peak memory regressed by more than the threshold (in percent), if a metric of
+# the baseline is missing, if ccdoc fails or if there is no baseline file.
+#
+# usage: bench.sh record BASELINE
+#        bench.sh check BASELINE [THRESHOLD]
+#
+# APP (default ./ccdoc.exe) and RUNS (default 5) can be set in the environment.
+
+set -e
+
+APP=${APP:-./ccdoc.exe}
+RUNS=${RUNS:-5}
+FORMAT=1
+
+mode=$1
+baseline=$2
+threshold=${3:-10}
+
+if [ -z "$baseline" ] || { [ "$mode" != record ] && [ "$mode" != check ]; }; then
+	echo "usage: $0 record|check BASELINE [THRESHOLD]" >&2
+	exit 2
+fi
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# large corpus: 2000 documented functions, generated the same way every time;
+# the scanner takes only letters and '_' in names, so the numbers are spelled in letters
+large_corpus() {
+	awk 'BEGIN {
+		for (i = 0; i < 2000; i++) {
+			name = ""
+			n = i
+			do {
+				name = substr("abcdefghijklmnopqrstuvwxyz", n % 26 + 1, 1) name
+				n = int(n / 26)
+			} while (n > 0)
+			printf "/**\n * @brief Function number %d\n * Computes the value of item %d.\n", i, i
+			printf " * @param int x The input value\n * @return int The result\n"
+			printf " * @author Bench\n * @version 1.0.%d\n */\nint bench_%s(int x)\n\n", i, name
+		}
+	}'
+}
+
+large_corpus > "$work/large.c"
+
+# corpus name and root file
+corpus_dir=$(dirname "$0")/corpus
+set -- tiny "$corpus_dir/tiny.c" self "$corpus_dir/parser.y" large "$work/large.c"
+
+: > "$work/current"
+while [ $# -gt 0 ]; do
+	corpus=$1
+	source=$2
+	shift 2
+
+	: > "$work/runs"
+	run=0
+	while [ $run -lt "$RUNS" ]; do
+		status=0
+		"$APP" --stats "$source" "$work/out.tex" > /dev/null 2> "$work/stderr" || status=$?
+		if [ $status -ne 0 ]; then
+			echo "ccdoc failed on $corpus with exit status $status" >&2
+			exit 1
+		fi
+		grep '^stats ' "$work/stderr" >> "$work/runs" || true
+		run=$((run + 1))
+	done
+
+	# median of every metric
+	sort -k2,2 -k3,3g "$work/runs" | awk -v corpus="$corpus" '
+		{ values[$2, ++count[$2]] = $3 }
+		END {
+			for (metric in count) {
+				n = count[metric]
+				print corpus, metric, values[metric, int((n + 1) / 2)]
+			}
+		}' | sort >> "$work/current"
+done
+
+if [ "$mode" = record ]; then
+	{
+		echo "# ccdoc benchmark baseline, format $FORMAT"
+		echo "# recorded on $(uname -sm) with $APP"
+		echo "# corpus metric median ($RUNS runs)"
+		cat "$work/current"
+	} > "$baseline"
+	echo "Baseline written to $baseline"
+	exit 0
+fi
+
+if [ ! -f "$baseline" ]; then
+	echo "No baseline $baseline, run 'make bench' to record it" >&2
+	exit 2
+fi
+
+if ! grep -q "^# ccdoc benchmark baseline, format $FORMAT\$" "$baseline"; then
+	echo "Baseline $baseline has another format, record it again" >&2
+	exit 2
+fi
+
+awk -v threshold="$threshold" '
+	NR == FNR {
+		if ($1 != "#") base[$1 " " $2] = $3
+		next
+	}
+	{
+		key = $1 " " $2
+		seen[key] = 1
+		if (!(key in base)) next
+		old = base[key]
+		change = old != 0 ? ($3 - old) * 100 / old : 0
+		verdict = ""
+		# higher is worse for times and memory, lower for throughput
+		if (($2 == "wall_ms" || $2 == "rss_kb") && change > threshold) verdict = "REGRESSION"
+		if ($2 == "tokens_per_s" && -change > threshold) verdict = "REGRESSION"
+		if (verdict != "") failed++
+		printf "%-6s %-13s %12s %12s %+8.1f%% %s\n", $1, $2, old, $3, change, verdict
+	}
+	END {
+		# a metric that is no longer reported counts as a regression
+		for (key in base) {
+			if (key in seen) continue
+			split(key, part, " ")
+			printf "%-6s %-13s %12s %12s %9s %s\n", part[1], part[2], base[key], "-", "", "MISSING"
+			failed++
+		}
+		if (failed) {
+			printf "%d metrics regressed by more than %s%% or missing\n", failed, threshold
+			exit 1
+		}
+		printf "No regression beyond %s%%\n", threshold
+	}' "$baseline" "$work/current"
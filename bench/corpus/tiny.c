@@ -0,0 +1,37 @@
+#include "list.h"
+/**
+* My variable
+*/
+int my_variable;
+
+
+/**
+* Main function brief
+* Tato funkce představuje hlavní ...
+* Second line description of details
+*  int argc Počet parametrů, předávaných programu na příkazové řádce.
+* char* argv[] Pole řetězců odpovídajících jednotlivým předaným parametrům.
+*  int Hodnota, předávaná operačnímu systému přiukončení programu.
+*  \textcopyright{} Světák Bob
+*  1.0.0
+*/
+int main(int argc, char* argv[]) {
+	int i = 5;
+	i++;
+	return 0;
+}
+
+/**
+* @brief Výpis celé databáze.
+* @details Tato funkce vypisuje do konzole obsah pole, které udržuje ukazatele
+* na všechny instance položek tvořících databázi.
+* @param entry* data [] Pole ukazatelů na jednotlivé položky databáze.
+* @param int dsize Velikost pole udržujícího databázi.
+* @return int Indikátor úspěchu (0 = neúspěch , 1 = úspěch).
+* @author \textcopyright{} Jan Naj
+* @version 1.1.3
+*/
+int dump(entry* data[], int dsize) {
+	return 7;
+}
+
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cache.h"
+#include "text.h"
+#include "parserfuncs.h"
+
+extern list_t* includes;
+
+bool cache_enabled = false;
+int cache_hits = 0;
+int cache_misses = 0;
+
+/**
+ * List of all cached modules (cache_entry_t)
+ */
+static list_t* module_cache = NULL;
+
+/**
+ * Modules included by the module which is being parsed
+ */
+static list_t* module_dependencies = NULL;
+
+
+static void cache_entry_free(cache_entry_t* entry) {
+	free(entry->filename);
+	free(entry->fragment);
+	if (entry->modules != NULL) list_free(entry->modules, free);
+	free(entry);
+}
+
+
+static cache_entry_t* cache_find(char* filename) {
+	list_node_t* p;
+	if (module_cache == NULL) return NULL;
+
+	for (p = module_cache->first; p != NULL; p = p->next) {
+		cache_entry_t* entry = p->value;
+		if (text_equal_func(entry->filename, filename)) return entry;
+	}
+	return NULL;
+}
+
+
+/**
+ * Queue a dependency of a cached module, the same way the parser does it
+ */
+static void cache_queue_module(char* filename) {
+	char* s = text_copy(filename);
+	if (!list_add_unique(includes, s, (bool(*)(void*,void*))text_equal_func)) {
+		free(s);
+	}
+}
+
+
+bool cache_emit(char* filename, unsigned long hash) {
+	cache_entry_t* entry = cache_find(filename);
+
+	if (entry == NULL || entry->hash != hash) return false;
+
+	fwrite(entry->fragment, 1, entry->length, yyout);
+	if (entry->modules != NULL) {
+		list_apply_foreach(entry->modules, (void(*)(void*))cache_queue_module);
+	}
+	cache_hits++;
+	return true;
+}
+
+
+void cache_add_dependency(char* filename) {
+	char* s;
+	if (!cache_enabled) return;
+
+	s = text_copy(filename);
+	if (module_dependencies == NULL) {
+		module_dependencies = list_new(s);
+	} else {
+		list_add_object_back(module_dependencies, s);
+	}
+}
+
+
+void cache_store(char* filename, unsigned long hash, FILE* fragment, FILE* outfile, bool keep) {
+	cache_entry_t* entry;
+	char* buffer;
+	size_t length;
+
+	rewind(fragment);
+	buffer = text_read_stream(fragment, &length);
+	fwrite(buffer, 1, length, outfile);
+	cache_misses++;
+
+	if (!keep) {
+		free(buffer);
+		if (module_dependencies != NULL) list_free(module_dependencies, free);
+		module_dependencies = NULL;
+		return;
+	}
+
+	entry = cache_find(filename);
+	if (entry == NULL) {
+		entry = malloc(sizeof(cache_entry_t));
+		entry->filename = text_copy(filename);
+		if (module_cache == NULL) {
+			module_cache = list_new(entry);
+		} else {
+			list_add_object_back(module_cache, entry);
+		}
+	} else {
+		/* the module has changed */
+		free(entry->fragment);
+		if (entry->modules != NULL) list_free(entry->modules, free);
+	}
+
+	entry->hash = hash;
+	entry->fragment = buffer;
+	entry->length = length;
+	entry->modules = module_dependencies;
+	module_dependencies = NULL;
+}
+
+
+void cache_reset_counters(void) {
+	cache_hits = 0;
+	cache_misses = 0;
+}
+
+
+void cache_free(void) {
+	if (module_cache != NULL) {
+		list_free(module_cache, (void(*)(void*))cache_entry_free);
+	}
+	module_cache = NULL;
+}
@@ -0,0 +1,105 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "list.h"
+
+/**
+ * Struct cache_entry_t
+ *
+ * It keeps the rendered LaTeX fragment of one parsed module together with the hash of the
+ * module's content, so the module can be emitted again without parsing while it's unchanged.
+ * The modules included by the module are kept as well, they have to be queued on a hit.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+typedef struct cache_entry_t {
+	char* filename;
+	unsigned long hash;
+	char* fragment;
+	size_t length;
+	list_t* modules;
+} cache_entry_t;
+
+/**
+ * Cache enabled variable
+ *
+ * Modules are cached only when it's set, ccdoc does it in the worker mode.
+ */
+extern bool cache_enabled;
+
+/**
+ * Count of modules emitted from the cache since the last 'cache_reset_counters'
+ */
+extern int cache_hits;
+
+/**
+ * Count of modules parsed since the last 'cache_reset_counters'
+ */
+extern int cache_misses;
+
+/**
+ * Emit cached module function
+ *
+ * If the cache holds the module with the same content hash, the function writes its fragment
+ * to 'yyout' and queues the modules it includes.
+ *
+ * @param char* filename The full name of the module.
+ * @param unsigned long hash Hash of the current content of the module.
+ * @return bool Result (1(true) - the module was emitted, 0(false) - it has to be parsed).
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+bool cache_emit(char* filename, unsigned long hash);
+
+/**
+ * Add dependency function
+ *
+ * The parser calls it for every module included by the parsed module. Nothing is done while
+ * caching is disabled.
+ *
+ * @param char* filename The full name of the included module, it's copied.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void cache_add_dependency(char* filename);
+
+/**
+ * Store module function
+ *
+ * The function copies the fragment rendered into a temporary stream to the output and, if the
+ * module was parsed successfully, stores it in the cache together with the collected dependencies.
+ *
+ * @param char* filename The full name of the module.
+ * @param unsigned long hash Hash of the content the fragment was rendered from.
+ * @param FILE* fragment The temporary stream with the rendered fragment.
+ * @param FILE* outfile The stream where the fragment is copied.
+ * @param bool keep Whether the fragment can be stored in the cache.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void cache_store(char* filename, unsigned long hash, FILE* fragment, FILE* outfile, bool keep);
+
+/**
+ * Reset counters function
+ *
+ * The function sets the hit and miss counts to 0, the cached modules are kept.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void cache_reset_counters(void);
+
+/**
+ * Free cache function
+ *
+ * The function releases all cached modules.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void cache_free(void);
+
+#endif
@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "diagnostic.h"
+#include "location.h"
+#include "text.h"
+
+int diagnostic_count = 0;
+
+/**
+ * List of all collected diagnostics (diagnostic_t)
+ */
+static list_t* diagnostics = NULL;
+
+
+static void diagnostic_entry_free(diagnostic_t* diagnostic) {
+	free(diagnostic->filename);
+	free(diagnostic->reason);
+	free(diagnostic);
+}
+
+
+static void diagnostic_print(diagnostic_t* diagnostic, FILE* stream) {
+	fprintf(stream, "%s:%d:%d: offset %ld: %s\n", diagnostic->filename, diagnostic->line,
+		diagnostic->column, diagnostic->offset, diagnostic->reason);
+}
+
+
+void diagnostic_add(char* filename, long offset, char* reason) {
+	diagnostic_t* diagnostic = malloc(sizeof(diagnostic_t));
+
+	diagnostic->filename = text_copy(filename ? filename : "-");
+	diagnostic->offset = offset;
+	diagnostic->reason = text_copy(reason);
+	if (!location_resolve(offset, &diagnostic->line, &diagnostic->column)) {
+		diagnostic->line = 0;
+		diagnostic->column = 0;
+	}
+
+	if (diagnostics == NULL) {
+		diagnostics = list_new(diagnostic);
+	} else {
+		list_add_object_back(diagnostics, diagnostic);
+	}
+	diagnostic_count++;
+}
+
+
+void diagnostic_report(FILE* stream) {
+	list_node_t* p;
+	if (diagnostics == NULL) return;
+
+	fprintf(stream, "Diagnostics (%d):\n", diagnostic_count);
+	for (p = diagnostics->first; p != NULL; p = p->next) {
+		diagnostic_print(p->value, stream);
+	}
+}
+
+
+void diagnostic_free(void) {
+	if (diagnostics != NULL) {
+		list_free(diagnostics, (void(*)(void*))diagnostic_entry_free);
+	}
+	diagnostics = NULL;
+	diagnostic_count = 0;
+}
@@ -0,0 +1,64 @@
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+
+#include <stdio.h>
+#include "list.h"
+
+/**
+ * Struct diagnostic_t
+ *
+ * It describes one syntax error the parser recovered from. The line and the column are
+ * resolved from the offset when the error is found, they are 0 if it wasn't possible.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+typedef struct diagnostic_t {
+	char* filename;
+	long offset;
+	int line;
+	int column;
+	char* reason;
+} diagnostic_t;
+
+/**
+ * Count of diagnostics collected since the last 'diagnostic_free'
+ */
+extern int diagnostic_count;
+
+/**
+ * Add diagnostic function
+ *
+ * The function records an error of the current module, its line and column are resolved right away.
+ *
+ * @param char* filename The file where the error was found, it's copied.
+ * @param long offset Byte offset of the token the error was found at.
+ * @param char* reason Description of the error, it's copied.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void diagnostic_add(char* filename, long offset, char* reason);
+
+/**
+ * Report diagnostics function
+ *
+ * The function prints all collected diagnostics, one per line in the form
+ * "file:line:column: offset N: reason". Nothing is printed if there are none.
+ *
+ * @param FILE* stream The stream to print to.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void diagnostic_report(FILE* stream);
+
+/**
+ * Free diagnostics function
+ *
+ * The function releases all collected diagnostics and sets the count to 0.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void diagnostic_free(void);
+
+#endif
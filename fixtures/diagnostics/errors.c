@@ -0,0 +1,14 @@
+/**
+ * @brief First error, a comment before a macro
+ */
+#define FIRST 1
+
+/**
+ * @brief Second error
+ */
+#define SECOND 2
+
+/**
+ * @brief Fine
+ */
+int fine;
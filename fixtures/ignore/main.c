@@ -0,0 +1,7 @@
+#include "src/a.h"
+#include "src/gen.h"
+
+/**
+ * @brief Entry point of the ignore fixture
+ */
+int main(void);
@@ -0,0 +1,8 @@
+#include "vendor/v.h"
+#include "sub/gen.h"
+#include "b.h"
+
+/**
+ * @brief Kept, it isn't matched by any rule
+ */
+int a;
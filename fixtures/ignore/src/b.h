@@ -0,0 +1,4 @@
+/**
+ * @brief Kept, a plain header next to the ignored ones
+ */
+int b;
@@ -0,0 +1,4 @@
+/**
+ * @brief Skipped by .ccdocignore
+ */
+int skipped;
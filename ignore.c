@@ -0,0 +1,245 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ignore.h"
+#include "list.h"
+#include "text.h"
+#include "parserfuncs.h"
+
+/*
+ * Kinds of compiled patterns
+ */
+#define IGNORE_EXACT 1
+#define IGNORE_PREFIX 2
+#define IGNORE_SUFFIX 3
+#define IGNORE_GLOB 4
+
+/**
+ * Struct ignore_rule_t
+ *
+ * One compiled pattern. For the direct kinds 'literal' holds the text to compare.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+typedef struct ignore_rule_t {
+	int kind;
+	bool basename;
+	char* pattern;
+	char* literal;
+	size_t length;
+} ignore_rule_t;
+
+long ignore_max_size = 0;
+bool ignore_sniff = true;
+
+/**
+ * List of all compiled rules (ignore_rule_t)
+ */
+static list_t* ignore_rules = NULL;
+
+/**
+ * Markers of generated files
+ */
+static char* ignore_markers[] = {
+	"DO NOT EDIT",
+	"@generated",
+	"A Bison parser, made by",
+	"A lexical scanner generated by flex",
+	NULL
+};
+
+
+static void ignore_rule_free(ignore_rule_t* rule) {
+	free(rule->pattern);
+	free(rule);
+}
+
+
+void ignore_add_pattern(char* pattern) {
+	ignore_rule_t* rule;
+	size_t length;
+	size_t wildcards;
+
+	/* the paths are compared without "./" as well */
+	while (pattern[0] == '.' && pattern[1] == DIRECTORY_SEPARATOR) pattern += 2;
+	length = strlen(pattern);
+	wildcards = strcspn(pattern, "*?[");
+	if (length == 0) return;
+
+	rule = malloc(sizeof(ignore_rule_t));
+	rule->pattern = text_copy(pattern);
+	rule->basename = strchr(pattern, DIRECTORY_SEPARATOR) == NULL;
+	rule->kind = IGNORE_GLOB;
+	rule->literal = rule->pattern;
+	rule->length = length;
+
+	if (wildcards == length) {
+		rule->kind = IGNORE_EXACT;
+	} else if (rule->basename && pattern[0] == '*' && strcspn(pattern + 1, "*?[") == length - 1) {
+		/* "*.tab.c" */
+		rule->kind = IGNORE_SUFFIX;
+		rule->literal = rule->pattern + 1;
+		rule->length = length - 1;
+	} else if (wildcards == length - 2 && strcmp(pattern + length - 2, "**") == 0) {
+		/* everything below a directory */
+		rule->kind = IGNORE_PREFIX;
+		rule->length = length - 2;
+	}
+
+	if (ignore_rules == NULL) {
+		ignore_rules = list_new(rule);
+	} else {
+		list_add_object_back(ignore_rules, rule);
+	}
+}
+
+
+bool ignore_load_file(char* filename) {
+	FILE* f;
+	char line[1024];
+
+	f = fopen(filename, "r");
+	if (f == NULL) return false;
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		size_t length = strcspn(line, "\r\n");
+		while (length > 0 && (line[length - 1] == ' ' || line[length - 1] == '\t')) length--;
+		line[length] = '\0';
+
+		if (length == 0 || line[0] == '#') continue;
+		ignore_add_pattern(line);
+	}
+	fclose(f);
+	return true;
+}
+
+
+/**
+ * Glob matching, '*' and '?' stop at the directory separator
+ */
+static bool ignore_glob_match(char* pattern, char* text) {
+	for (; *pattern != '\0'; pattern++, text++) {
+		if (pattern[0] == '*' && pattern[1] == '*' && pattern[2] == DIRECTORY_SEPARATOR) {
+			/* "**" followed by a separator matches zero or more whole directories */
+			for (pattern += 3; ; text++) {
+				if (ignore_glob_match(pattern, text)) return true;
+				text = strchr(text, DIRECTORY_SEPARATOR);
+				if (text == NULL) return false;
+			}
+		}
+		if (pattern[0] == '*' && pattern[1] == '*') {
+			for (pattern += 2; ; text++) {
+				if (ignore_glob_match(pattern, text)) return true;
+				if (*text == '\0') return false;
+			}
+		}
+		if (*pattern == '*') {
+			for (pattern++; ; text++) {
+				if (ignore_glob_match(pattern, text)) return true;
+				if (*text == '\0' || *text == DIRECTORY_SEPARATOR) return false;
+			}
+		}
+		if (*text == '\0') return false;
+		if (*pattern == '?') {
+			if (*text == DIRECTORY_SEPARATOR) return false;
+		} else if (*pattern == '[') {
+			char* end = strchr(pattern + 1, ']');
+			bool negate = pattern[1] == '!';
+			bool found = false;
+			char* c;
+			if (end == NULL) return false;
+			for (c = pattern + 1 + negate; c < end; c++) {
+				if (c[1] == '-' && c + 2 < end) {
+					/* range "a-z" */
+					found = found || (*text >= c[0] && *text <= c[2]);
+					c += 2;
+				} else {
+					found = found || *text == *c;
+				}
+			}
+			if (found == negate) return false;
+			pattern = end;
+		} else if (*pattern != *text) {
+			return false;
+		}
+	}
+	return *text == '\0';
+}
+
+
+static bool ignore_rule_match(ignore_rule_t* rule, char* path, size_t length) {
+	char* name = path;
+
+	if (rule->basename) {
+		char* separator = strrchr(path, DIRECTORY_SEPARATOR);
+		if (separator != NULL) name = separator + 1;
+		length -= name - path;
+	}
+
+	switch (rule->kind) {
+	case IGNORE_EXACT:
+		return length == rule->length && memcmp(name, rule->literal, length) == 0;
+	case IGNORE_SUFFIX:
+		return length >= rule->length && memcmp(name + length - rule->length, rule->literal, rule->length) == 0;
+	case IGNORE_PREFIX:
+		return length >= rule->length && memcmp(name, rule->literal, rule->length) == 0;
+	default:
+		return ignore_glob_match(rule->pattern, name);
+	}
+}
+
+
+bool ignore_path(char* path) {
+	list_node_t* p;
+	size_t length;
+
+	if (ignore_rules == NULL) return false;
+
+	/* "./src/a.h" is the same as "src/a.h" */
+	while (path[0] == '.' && path[1] == DIRECTORY_SEPARATOR) path += 2;
+	length = strlen(path);
+
+	for (p = ignore_rules->first; p != NULL; p = p->next) {
+		if (ignore_rule_match(p->value, path, length)) return true;
+	}
+	return false;
+}
+
+
+bool ignore_stream(FILE* f, char** reason) {
+	char head[IGNORE_SNIFF_BYTES + 1];
+	size_t n;
+	int i;
+
+	if (ignore_max_size > 0 && fseek(f, 0, SEEK_END) == 0) {
+		long size = ftell(f);
+		rewind(f);
+		if (size > ignore_max_size) {
+			*reason = "too large";
+			return true;
+		}
+	}
+
+	if (!ignore_sniff) return false;
+
+	n = fread(head, 1, IGNORE_SNIFF_BYTES, f);
+	head[n] = '\0';
+	rewind(f);
+
+	for (i = 0; ignore_markers[i] != NULL; i++) {
+		if (strstr(head, ignore_markers[i]) != NULL) {
+			*reason = "a generated file";
+			return true;
+		}
+	}
+	return false;
+}
+
+
+void ignore_free(void) {
+	if (ignore_rules != NULL) {
+		list_free(ignore_rules, (void(*)(void*))ignore_rule_free);
+	}
+	ignore_rules = NULL;
+}
@@ -0,0 +1,97 @@
+#ifndef IGNORE_H
+#define IGNORE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+/*
+ * Name of the file with ignore rules, it's read from the working directory
+ */
+#define IGNORE_FILE ".ccdocignore"
+
+/*
+ * Count of bytes from the beginning of a module searched for a "generated file" marker
+ */
+#define IGNORE_SNIFF_BYTES 512
+
+/**
+ * Maximal size of a module in bytes, larger modules are skipped (0 - no limit)
+ */
+extern long ignore_max_size;
+
+/**
+ * Sniff variable
+ *
+ * If it's set, modules with a "generated file" marker in the beginning are skipped.
+ */
+extern bool ignore_sniff;
+
+/**
+ * Add pattern function
+ *
+ * The function compiles a glob pattern and adds it to the rules. '*' and '?' don't match
+ * the directory separator, '**' matches anything and '**' followed by a separator matches zero
+ * or more directories. A pattern without a separator is matched against the file name only,
+ * other patterns against the whole path as it's queued, which is relative to the working
+ * directory (where '.ccdocignore' is read from). So 'vendor/' followed by '**' skips only
+ * './vendor'; to skip a directory at any depth, the pattern has to start with '**' and
+ * a separator. Patterns that are a plain name, a prefix or a suffix are compared directly
+ * without the glob matching.
+ *
+ * @param char* pattern The pattern, it's copied.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void ignore_add_pattern(char* pattern);
+
+/**
+ * Load ignore file function
+ *
+ * The function adds a pattern for every line of the file. Empty lines and lines starting
+ * with '#' are skipped.
+ *
+ * @param char* filename The name of the file.
+ * @return bool Result (1(true) - loaded, 0(false) - the file can't be opened)
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+bool ignore_load_file(char* filename);
+
+/**
+ * Ignore path function
+ *
+ * The function matches the path against all rules, the first matching rule decides.
+ *
+ * @param char* path The path of a module which is going to be queued.
+ * @return bool Result (1(true) - the module matches a rule and is skipped, 0(false) - otherwise)
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+bool ignore_path(char* path);
+
+/**
+ * Ignore stream function
+ *
+ * The function checks an opened module before it's read: its size against 'ignore_max_size'
+ * and its first bytes for a marker of a generated file ("DO NOT EDIT", "@generated", Bison
+ * and flex headers). The stream is set back to the beginning.
+ *
+ * @param FILE* f The opened module, it has to be seekable.
+ * @param char** reason Pointer where the reason of skipping is stored.
+ * @return bool Result (1(true) - the module is skipped, 0(false) - otherwise)
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+bool ignore_stream(FILE* f, char** reason);
+
+/**
+ * Free rules function
+ *
+ * The function releases all compiled rules.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void ignore_free(void);
+
+#endif
@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "latex.h"
+#include "text.h"
+#include "parserfuncs.h"
+
+
+/**
+ * Name of the file produced by pdflatex next to the LaTeX file
+ *
+ * The name is made of the job name and the extension in the output directory.
+ *
+ * @param char* directory Output directory with the separator in the end, or NULL.
+ * @param char* jobname Name of the LaTeX file without directory and extension.
+ * @param char* ext Extension of the produced file (with dot).
+ * @return char* A newly allocated file name.
+ */
+static char* latex_job_file(char* directory, char* jobname, char* ext) {
+	char* s;
+	char* path;
+
+	s = malloc(strlen(jobname) + strlen(ext) + 1);
+	strcpy(s, jobname);
+	strcat(s, ext);
+	path = make_full_path(directory, s);
+	free(s);
+	return path;
+}
+
+
+/**
+ * Hash of a file, files that don't exist have hash 0
+ */
+static unsigned long latex_file_state(char* filename) {
+	unsigned long hash;
+	if (!text_file_hash(filename, &hash)) return 0;
+	return hash;
+}
+
+
+/**
+ * Read the stamp of the PDF
+ *
+ * The stamp holds the hash of the LaTeX file the PDF was built from, it's written only after a successful build.
+ *
+ * @param char* stamp Name of the stamp file.
+ * @param unsigned long* hash Place for the hash.
+ * @return bool Whether the stamp file exists and is valid.
+ */
+static bool latex_read_stamp(char* stamp, unsigned long* hash) {
+	FILE* f;
+	int n;
+
+	f = fopen(stamp, "r");
+	if (f == NULL) return false;
+	n = fscanf(f, "%lu", hash);
+	fclose(f);
+	return n == 1;
+}
+
+
+/*
+ * Characters the shell interprets inside double quotes
+ */
+#if defined(_MSC_VER)
+#define LATEX_UNSAFE "\"%"
+#else
+#define LATEX_UNSAFE "\"$`\\"
+#endif
+
+
+int latex_build_pdf(char* texfile) {
+	char* directory;
+	char* jobname;
+	char* ptr;
+	char* aux;
+	char* toc;
+	char* pdf;
+	char* stamp;
+	char* command;
+	FILE* f;
+	int pass;
+	int result = 0;
+	unsigned long tex_hash = 0;
+	unsigned long built_hash = 0;
+	bool tex_changed;
+
+	/* the name is passed to the shell */
+	if (texfile[strcspn(texfile, LATEX_UNSAFE)] != '\0') {
+		fprintf(stderr, "LaTeX error: file name %s can't be passed to pdflatex\n", texfile);
+		return 4;
+	}
+
+	directory = text_current_directory(texfile);
+	jobname = text_copy(directory ? texfile + strlen(directory) : texfile);
+	ptr = strrchr(jobname, '.');
+	if (ptr != NULL) *ptr = '\0';
+
+	aux = latex_job_file(directory, jobname, ".aux");
+	toc = latex_job_file(directory, jobname, ".toc");
+	pdf = latex_job_file(directory, jobname, ".pdf");
+	stamp = latex_job_file(directory, jobname, ".stamp");
+
+	/* the PDF is compared with the LaTeX file it was really built from */
+	tex_changed = !text_file_hash(texfile, &tex_hash) || !latex_read_stamp(stamp, &built_hash)
+		|| tex_hash != built_hash;
+
+	f = fopen(pdf, "r");
+	if (f != NULL) fclose(f);
+
+	if (!tex_changed && f != NULL) {
+		fprintf(log_stream, "LaTeX: %s is up to date, pdflatex skipped\n", pdf);
+	} else {
+		command = malloc(strlen(texfile) + (directory ? strlen(directory) : 1) + 96);
+		sprintf(command, "pdflatex -interaction=nonstopmode -halt-on-error -output-directory \"%s\" \"%s\"%s",
+			directory ? directory : ".", texfile, log_stream == stdout ? "" : " 1>&2");
+
+		/* a failed build must not look up to date next time */
+		remove(stamp);
+
+		for (pass = 1; pass <= LATEX_MAX_PASSES; pass++) {
+			unsigned long aux_hash = latex_file_state(aux);
+			unsigned long toc_hash = latex_file_state(toc);
+
+			fprintf(log_stream, "LaTeX: pass %d\n", pass);
+			if (system(command) != 0) {
+				fprintf(stderr, "LaTeX error: pdflatex failed on %s\n", texfile);
+				result = 4;
+				break;
+			}
+
+			if (aux_hash == latex_file_state(aux) && toc_hash == latex_file_state(toc)) {
+				break;
+			}
+		}
+		free(command);
+
+		if (result == 0) {
+			f = fopen(stamp, "w");
+			if (f != NULL) {
+				fprintf(f, "%lu\n", tex_hash);
+				fclose(f);
+			}
+		}
+	}
+
+	free(aux);
+	free(toc);
+	free(pdf);
+	free(stamp);
+	free(jobname);
+	if (directory != NULL) free(directory);
+	return result;
+}
@@ -0,0 +1,30 @@
+#ifndef LATEX_H
+#define LATEX_H
+
+#include <stdbool.h>
+
+/*
+ * Maximal count of pdflatex passes
+ *
+ * The passes are repeated while the .aux or .toc files change, this limit protects
+ * against documents whose references never settle.
+ */
+#define LATEX_MAX_PASSES 4
+
+/**
+ * Build PDF function
+ *
+ * This function compiles the generated LaTeX file into PDF with 'pdflatex'. The output is written into the directory
+ * of the LaTeX file. After a successful build the hash of the LaTeX file is stored in the '<job>.stamp' file; if the
+ * LaTeX file still has this hash and the PDF exists, pdflatex is not started at all. Otherwise the hashes of the .aux
+ * and .toc files are compared before and after each pass, and another pass is started only when one of them changed.
+ * A file name with a quote or another character the shell would interpret is refused.
+ *
+ * @param char* texfile The name of the generated LaTeX file.
+ * @return int Result (0 - success, 4 - pdflatex failed or the file name was refused).
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+int latex_build_pdf(char* texfile);
+
+#endif
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "location.h"
+#include "parserfuncs.h"
+
+long scan_offset = 0;
+long token_offset = 0;
+
+/**
+ * Content of the scanned file
+ */
+static char* location_source = NULL;
+
+/**
+ * Length of the scanned file
+ */
+static long location_length = 0;
+
+/**
+ * Offsets of all newlines of the scanned file, NULL until needed
+ */
+static long* newlines = NULL;
+
+/**
+ * Count of items in 'newlines'
+ */
+static long newlines_count = 0;
+
+
+void location_reset(char* source, long length) {
+	scan_offset = 0;
+	token_offset = 0;
+
+	location_source = source;
+	location_length = length;
+
+	if (newlines != NULL) free(newlines);
+	newlines = NULL;
+	newlines_count = 0;
+}
+
+
+/**
+ * Build the newline index of the scanned file
+ */
+static bool location_build_index(void) {
+	long offset;
+	long capacity = 256;
+
+	if (location_source == NULL) return false;
+
+	newlines = malloc(capacity * sizeof(long));
+	newlines_count = 0;
+
+	for (offset = 0; offset < location_length; offset++) {
+		char c = location_source[offset];
+
+		/* the lexer keeps a zero byte behind the current token */
+		if (c == '\0' && offset == scan_offset) c = scanner_held_char();
+		if (c == '\n') {
+			if (newlines_count == capacity) {
+				capacity *= 2;
+				newlines = realloc(newlines, capacity * sizeof(long));
+			}
+			newlines[newlines_count++] = offset;
+		}
+	}
+	return true;
+}
+
+
+bool location_resolve(long offset, int* line, int* column) {
+	long low = 0;
+	long high;
+
+	if (newlines == NULL && !location_build_index()) return false;
+
+	/* count of newlines before offset */
+	high = newlines_count;
+	while (low < high) {
+		long middle = low + (high - low) / 2;
+		if (newlines[middle] < offset) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	*line = (int)low + 1;
+	*column = (int)(low ? offset - newlines[low - 1] : offset + 1);
+	return true;
+}
+
+
+char* location_text(long offset) {
+	if (location_source == NULL || offset < 0 || offset > location_length) return NULL;
+	return location_source + offset;
+}
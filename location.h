@@ -0,0 +1,63 @@
+#ifndef LOCATION_H
+#define LOCATION_H
+
+#include <stdbool.h>
+
+/**
+ * Scan offset variable
+ *
+ * Byte offset in the current file just behind the last text matched by the lexer.
+ * The lexer advances it for every matched rule, nothing else is tracked on the common path.
+ */
+extern long scan_offset;
+
+/**
+ * Token offset variable
+ *
+ * Byte offset in the current file of the first character of the last matched text.
+ */
+extern long token_offset;
+
+/**
+ * Reset location function
+ *
+ * The function starts tracking of a new file. Both offsets are set to zero and the newline
+ * index of the previous file is dropped. The content isn't copied, it has to stay allocated
+ * while the file is scanned. Passing NULL only releases the memory.
+ *
+ * @param char* source Content of the file which is going to be scanned, or NULL
+ * @param long length Length of the content
+ * @version 1.1.0
+ * @author Faiz Suleimanov
+ */
+void location_reset(char* source, long length);
+
+/**
+ * Resolve location function
+ *
+ * The function converts a byte offset into a line and a column (both counted from 1).
+ * The newline index of the current file is built on the first call only, so a run
+ * without errors never pays for it.
+ *
+ * @param long offset Byte offset in the current file
+ * @param int* line Pointer where the line is stored
+ * @param int* column Pointer where the column is stored
+ * @return bool Result (1(true) - resolved, 0(false) - no file is tracked)
+ * @version 1.1.0
+ * @author Faiz Suleimanov
+ */
+bool location_resolve(long offset, int* line, int* column);
+
+/**
+ * Location text function
+ *
+ * The function gives access to the raw bytes of the current file, they aren't copied.
+ *
+ * @param long offset Byte offset in the current file
+ * @return char* Pointer to the content of the current file at the offset, or NULL if no file is tracked
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+char* location_text(long offset);
+
+#endif
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memo.h"
+#include "text.h"
+#include "location.h"
+#include "parserfuncs.h"
+
+/**
+ * Struct memo_entry_t
+ *
+ * One comment of the memo table, the raw bytes are kept to tell apart comments with the same hash.
+ * The fragment stays NULL until the comment repeats.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+typedef struct memo_entry_t {
+	struct memo_entry_t* next;
+	unsigned long hash;
+	int kind;
+	char* raw;
+	size_t raw_length;
+	char* fragment;
+	size_t length;
+} memo_entry_t;
+
+int memo_hits = 0;
+int memo_misses = 0;
+
+static memo_entry_t* memo_table[MEMO_BUCKETS];
+
+/**
+ * Bytes held by the memo table
+ */
+static long memo_size = 0;
+
+/**
+ * Raw bytes of the last marked comment
+ */
+static char* memo_raw = NULL;
+static size_t memo_raw_length = 0;
+
+/**
+ * State of the comment which is being rendered
+ */
+static int memo_kind = 0;
+static unsigned long memo_hash = 0;
+static memo_entry_t* memo_current = NULL;
+static FILE* memo_scratch = NULL;
+static FILE* memo_outfile = NULL;
+
+
+void memo_comment(long begin, long end) {
+	memo_raw = location_text(begin);
+	memo_raw_length = memo_raw ? (size_t)(end - begin) : 0;
+}
+
+
+bool memo_emit(int kind, FILE* outfile) {
+	memo_entry_t* p;
+
+	memo_current = NULL;
+	memo_kind = kind;
+	if (memo_raw == NULL) return false;
+
+	memo_hash = text_hash(memo_raw, memo_raw_length) ^ ((unsigned long)kind * 0x9e3779b1UL);
+	memo_hash &= 0xffffffffUL;
+
+	for (p = memo_table[memo_hash % MEMO_BUCKETS]; p != NULL; p = p->next) {
+		if (p->hash == memo_hash && p->kind == kind && p->raw_length == memo_raw_length
+				&& memcmp(p->raw, memo_raw, memo_raw_length) == 0) {
+			break;
+		}
+	}
+	memo_current = p;
+
+	if (p == NULL || p->fragment == NULL) return false;
+
+	fwrite(p->fragment, 1, p->length, outfile);
+	memo_hits++;
+	memo_raw = NULL;
+	return true;
+}
+
+
+FILE* memo_begin(FILE* outfile) {
+	memo_entry_t* entry;
+
+	memo_misses++;
+	if (memo_raw == NULL) return outfile;
+
+	/* the table is full, the comments are rendered directly */
+	if (memo_size >= MEMO_MAX_BYTES) return outfile;
+
+	if (memo_current == NULL) {
+		/* the first occurrence is rendered directly */
+		entry = malloc(sizeof(memo_entry_t));
+		entry->hash = memo_hash;
+		entry->kind = memo_kind;
+		entry->raw = malloc(memo_raw_length + 1);
+		memcpy(entry->raw, memo_raw, memo_raw_length);
+		entry->raw_length = memo_raw_length;
+		entry->fragment = NULL;
+		entry->length = 0;
+		entry->next = memo_table[memo_hash % MEMO_BUCKETS];
+		memo_table[memo_hash % MEMO_BUCKETS] = entry;
+		memo_size += (long)(sizeof(memo_entry_t) + memo_raw_length + 1);
+		return outfile;
+	}
+
+	if (memo_scratch == NULL) memo_scratch = tmpfile();
+	if (memo_scratch == NULL) return outfile;
+
+	rewind(memo_scratch);
+	memo_outfile = outfile;
+	yyout = memo_scratch;
+	return memo_scratch;
+}
+
+
+void memo_end(FILE* outfile) {
+	long length;
+
+	/* the raw bytes belong to the scanned file */
+	memo_raw = NULL;
+	if (outfile != memo_scratch || memo_outfile == NULL) return;
+
+	length = ftell(memo_scratch);
+	rewind(memo_scratch);
+	memo_current->fragment = malloc(length + 1);
+	memo_current->length = fread(memo_current->fragment, 1, length, memo_scratch);
+	memo_size += length + 1;
+	fwrite(memo_current->fragment, 1, memo_current->length, memo_outfile);
+
+	yyout = memo_outfile;
+	memo_outfile = NULL;
+}
+
+
+void memo_reset(void) {
+	memo_hits = 0;
+	memo_misses = 0;
+}
+
+
+void memo_report(FILE* stream) {
+	fprintf(stream, "Memo: %d hits, %d misses\n", memo_hits, memo_misses);
+}
+
+
+void memo_free(void) {
+	int i;
+	for (i = 0; i < MEMO_BUCKETS; i++) {
+		memo_entry_t* p = memo_table[i];
+		while (p != NULL) {
+			memo_entry_t* next = p->next;
+			free(p->raw);
+			if (p->fragment != NULL) free(p->fragment);
+			free(p);
+			p = next;
+		}
+		memo_table[i] = NULL;
+	}
+	memo_size = 0;
+	if (memo_scratch != NULL) fclose(memo_scratch);
+	memo_scratch = NULL;
+}
@@ -0,0 +1,121 @@
+#ifndef MEMO_H
+#define MEMO_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+/*
+ * Kinds of declarations following a comment
+ */
+#define MEMO_FUNCTION 1
+#define MEMO_VARIABLE 2
+#define MEMO_STRUCT 3
+
+/*
+ * Count of buckets of the memo table
+ */
+#define MEMO_BUCKETS 4096
+
+/*
+ * Size of the memoized comments and fragments in bytes, after which no new comment is memoized
+ *
+ * The table lives as long as the program, in the worker mode it's shared by all the requests.
+ */
+#define MEMO_MAX_BYTES (16L * 1024 * 1024)
+
+/**
+ * Count of comments emitted from the memo table
+ */
+extern int memo_hits;
+
+/**
+ * Count of comments rendered
+ */
+extern int memo_misses;
+
+/**
+ * Mark comment function
+ *
+ * The parser calls it when a special comment is complete. The comment is identified by its raw
+ * bytes in the scanned file, identical comments are rendered identically.
+ *
+ * @param long begin Offset of the beginning of the comment ('/' of the opening sequence).
+ * @param long end Offset just behind the end of the comment.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void memo_comment(long begin, long end);
+
+/**
+ * Emit memoized comment function
+ *
+ * If the last marked comment was already rendered for the same kind of declaration, the function
+ * writes the rendered text to the output.
+ *
+ * @param int kind Kind of the declaration (MEMO_FUNCTION, MEMO_VARIABLE or MEMO_STRUCT).
+ * @param FILE* outfile The stream where the text is written.
+ * @return bool Result (1(true) - the text was written, 0(false) - the comment has to be rendered).
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+bool memo_emit(int kind, FILE* outfile);
+
+/**
+ * Begin rendering function
+ *
+ * The function is called before a comment that wasn't emitted by 'memo_emit' is rendered.
+ * A comment seen for the first time is only remembered and rendered directly. When it repeats,
+ * it's rendered into a temporary stream (it's set to 'yyout' as well) to be memoized.
+ *
+ * @param FILE* outfile The stream where the comment belongs.
+ * @return FILE* The stream where the comment has to be rendered.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+FILE* memo_begin(FILE* outfile);
+
+/**
+ * End rendering function
+ *
+ * If the comment was rendered into the temporary stream, the function stores the text and copies
+ * it to the original stream, which is set back to 'yyout'.
+ *
+ * @param FILE* outfile The stream returned by 'memo_begin'.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void memo_end(FILE* outfile);
+
+/**
+ * Reset counters function
+ *
+ * The function sets the hit and miss counts to 0, it's called before each document. The memoized
+ * comments are kept.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void memo_reset(void);
+
+/**
+ * Report function
+ *
+ * The function prints the hit and miss counts of the current document.
+ *
+ * @param FILE* stream The stream where the hit and miss counts are printed.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void memo_report(FILE* stream);
+
+/**
+ * Free memo function
+ *
+ * The function releases all memoized comments.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void memo_free(void);
+
+#endif
@@ -6,6 +6,15 @@
 	#include "text.h"
 	#include "func_param.h"
 	#include "comment_block.h"
+	#include "latex.h"
+	#include "location.h"
+	#include "cache.h"
+	#include "worker.h"
+	#include "prefetch.h"
+	#include "memo.h"
+	#include "diagnostic.h"
+	#include "ignore.h"
+	#include "stats.h"
 
 	/**
 	 * Comment block variable
@@ -31,12 +40,26 @@
 	 */
 	char* current_directory;
 
+	/**
+	 * Name of the parsed file variable
+	 * @version 1.0.0
+	 * @author Faiz Suleimanov
+	 */
+	char* current_filename;
+
 	/**
 	 * Error code variable
 	 * @version 2.0.0
 	 * @author Faiz Suleimanov
 	 */
 	int error_code;
+
+	/**
+	 * Stream for progress messages
+	 * @version 1.0.0
+	 * @author Faiz Suleimanov
+	 */
+	FILE* log_stream;
 	
 %} 
 
@@ -45,11 +68,12 @@
 }
 
 
-%token INFO_BEGIN INFO_END
+%token <offset> INFO_BEGIN INFO_END
 %token LINE_BREAK
 
 %union {
 	int intval;
+	long offset;
 	char* str;
 	list_t* list;
 }
@@ -62,6 +86,10 @@
 %type <intval> s
 %type <comment> header
 
+/* values dropped by the error recovery */
+%destructor { free($$); } <str>
+%destructor { list_free($$, free); } <list>
+
 
 %%
 
@@ -74,19 +102,20 @@ start: s {
 s:  /* empty */ { $$ = 0; }
 	| s MODULE_TOKEN {
 			char* s;
-			printf("parser: ADD MODULE %s\n", $2);
+			fprintf(log_stream, "parser: ADD MODULE %s\n", $2);
 			/* *.h files */
 			s = make_full_path(current_directory, $2);
-			if (list_add_unique(includes, s, (bool(*)(void*,void*))text_equal_func)) {
+			if (module_queue(s)) {
 				s = text_copy(s);
 			}
 
 			/* *.c files */
 			s[strlen(s)-1] = 'c'; 
-			if (!list_add_unique(includes, s, (bool(*)(void*,void*))text_equal_func)) {
+			if (!module_queue(s)) {
 				free(s);
 			}
 
+			free($2);
 			$$ = $1;
 		}
 	| s comment FUNCTION {
@@ -104,10 +133,17 @@ s:  /* empty */ { $$ = 0; }
 			free($3);
 			$$ = $$ + 1;
 		}
+	| s error {
+			/* tokens up to the next comment are skipped */
+			free_comment_block(&comment_block);
+			$$ = $1;
+		}
 	;
 
 comment: INFO_BEGIN { clear_comment_block(&comment_block); }
-	inf INFO_END
+	inf INFO_END {
+			memo_comment($1, $4);
+		}
 	;
 
 
@@ -195,62 +231,66 @@ TAG: TAG_BRIEF {
 %%
 
 /**
- * Main function entry point for the program.
+ * Read listed modules function
  *
- * This function serves as the main entry point of the program, handling command-line arguments
- * to process input files and generate LaTeX documentation. It expects a single source file name,
- * optionally followed by a destination file name. If no destination is provided, it appends '-doc.tex'
- * to the source file name to create one. The function initializes document structure for LaTeX,
- * processes the source file(s), and then finalizes the LaTeX document. 
+ * The function reads names from the list of modules until 'count' modules wait behind the node,
+ * so the next ones can be read ahead. It stops earlier at the end of the list.
  *
- * @param int argc Count of parameters passed to the program on the command line.
- * @param char* argv[] Array of strings corresponding to the individual parameters passed.
- * @return int Value returned to the operating system upon program termination.
- * @author Copyright(c) Faiz Suleimanov
+ * @param FILE* files The NUL-separated list of modules.
+ * @param list_node_t* node The node of the last parsed module, or NULL before the first one.
+ * @param int count Count of modules which should wait behind the node.
  * @version 1.0.0
+ * @author Faiz Suleimanov
  */
-int main(int argc, char **argv) { 
-	++argv, --argc;  /* skip over program name */
-	FILE* f; 
-	char* filename;
-
+static void document_read_names(FILE* files, list_node_t* node, int count) {
+	list_node_t* p;
+	int waiting;
+	char* name;
+
+	for (;;) {
+		waiting = 0;
+		for (p = node ? node->next : (includes ? includes->first : NULL); p != NULL && waiting < count; p = p->next) {
+			waiting++;
+		}
+		if (waiting >= count) return;
 
-	if (argc == 1) {
-		/* make output filename */
-		char* ptr = strrchr(argv[0], '.');
-		int len = (int)(ptr - argv[0]);
-		const char* ext = "-doc.tex";
-		ptr = malloc(len + strlen(ext) + 1);
-		strncpy(ptr, argv[0], len);
-		strcpy(ptr + len, ext);
-		yyout = fopen(ptr, "w");
-		free(ptr);
-	} else if (argc == 2) {
-		yyout = fopen(argv[1], "w");
-	} else {
-		/* error */
-		printf("Error. Format: ./ccdoc.exe {source file .h|.c|.y} {{destination file .tex}}\n");
-		return 1;
+		name = text_read_field(files, '\0');
+		if (name == NULL) return;
+		if (!module_queue(name)) free(name);
 	}
+}
 
-	f = fopen(argv[0], "r");
 
-	if (f == NULL) {
-		printf("I/O error: Can't open source file\n");
-		if (yyout) fclose(yyout);
-		return 2;
+int document_generate(char* source, FILE* files, char* outname, bool pdf) {
+	FILE* f; 
+	list_node_t* node;
+	list_node_t* next;
+
+	/* nothing is left from the previous document, even if this one fails */
+	current_directory = NULL;
+	includes = NULL;
+	error_code = 0;
+	diagnostic_free();
+	stats_reset();
+	memo_reset();
+	prefetch_reset();
+
+	if (files == NULL && strcmp(source, STDIO_NAME) != 0) {
+		f = fopen(source, "r");
+
+		if (f == NULL) {
+			fprintf(log_stream, "I/O error: Can't open source file\n");
+			return 2;
+		}
+		fclose(f);
 	}
 
+	yyout = strcmp(outname, STDIO_NAME) == 0 ? stdout : fopen(outname, "w");
+
 	if (yyout == NULL) {
-		printf("I/O error: Can't open destination file\n");
-		if (f) fclose(f);
+		fprintf(log_stream, "I/O error: Can't open destination file\n");
 		return 2;
 	}
-	fclose(f);
-
-	current_directory = NULL;
-	includes = NULL;
-	error_code = 0;
 
 	fputs("\\documentclass{article}\n" 
 		"\\usepackage[czech]{babel}\n" 
@@ -268,26 +308,202 @@ int main(int argc, char **argv) {
 		"\\pagenumbering{arabic}\n" 
 		"\\section{Programátorská dokumentace}\n", yyout);
 
-	/* first source file */
-	filename = text_copy(argv[0]);
-	includes = list_new(filename);
-	list_apply_foreach(includes, (void(*)(void*))module_parse_file);
-	list_free(includes, free);
+	/* first source file, the list grows while it's processed */
+	if (files == NULL) {
+		includes = list_new(text_copy(source));
+	}
+	for (node = NULL; ; node = next) {
+		/* the listed modules are taken as they come, only the read-ahead waits for more of them */
+		if (files != NULL) document_read_names(files, node, prefetch_depth + 1);
+
+		next = node ? node->next : (includes ? includes->first : NULL);
+		if (next == NULL) break;
+
+		prefetch_modules(next);
+		module_parse_file(next->value);
+
+		/* every module is passed on as soon as it's rendered */
+		fflush(yyout);
+	}
+	prefetch_report(log_stream);
+	memo_report(log_stream);
+	diagnostic_report(stderr);
+	if (includes != NULL) list_free(includes, free);
 	includes = NULL;
 
 	fputs("\\end{document}", yyout);
-	fclose(yyout);
+	if (yyout == stdout) {
+		fflush(yyout);
+	} else {
+		fclose(yyout);
+	}
+	yyout = NULL;
+
+	if (pdf) {
+		double start = stats_now();
+		int result = latex_build_pdf(outname);
+		stats_phase[STATS_PDF] += stats_now() - start;
+		if (result) error_code = result;
+	}
+
+	return error_code;
+}
+
+
+/**
+ * Main function entry point for the program.
+ *
+ * This function serves as the main entry point of the program, handling command-line arguments
+ * to process input files and generate LaTeX documentation. It expects a single source file name,
+ * optionally followed by a destination file name. If no destination is provided, it appends '-doc.tex'
+ * to the source file name to create one. The document itself is generated by 'document_generate'.
+ * With the '--pdf' option the LaTeX document is compiled into PDF afterwards. With the '--worker'
+ * option no file is given, the requests are read from the standard input instead. The '--readahead=N'
+ * option sets how many queued modules are loaded ahead of the parser by a reader thread. With '--files-from'
+ * it's also how many names are read from the list ahead, '--readahead=0' passes each module on before
+ * the next name comes. Modules matching a '--exclude=GLOB'
+ * option or a line of '.ccdocignore' are not queued, '--max-size=BYTES' and '--no-sniff' control
+ * skipping of large and generated modules. '--stats' prints the time of each phase, throughput and
+ * peak memory to stderr in the end. A source or destination '-' means the standard input or output.
+ * With '--files-from=FILE' no source file is given, the modules are read from a NUL-separated list
+ * ('-' for the standard input) and the document goes to the standard output unless a destination is given.
+ *
+ * @param int argc Count of parameters passed to the program on the command line.
+ * @param char* argv[] Array of strings corresponding to the individual parameters passed.
+ * @return int Value returned to the operating system upon program termination.
+ * @author Copyright(c) Faiz Suleimanov
+ * @version 1.3.0
+ */
+int main(int argc, char **argv) { 
+	char* outname;
+	char* source = NULL;
+	FILE* files = NULL;
+	bool pdf = false;
+	bool worker = false;
+	bool stats = false;
+	double start;
+	int result;
+
+	++argv, --argc;  /* skip over program name */
+	log_stream = stdout;
+
+	/* options */
+	while (argc > 0 && strncmp(argv[0], "--", 2) == 0) {
+		if (strcmp(argv[0], "--pdf") == 0) {
+			pdf = true;
+		} else if (strcmp(argv[0], "--worker") == 0) {
+			worker = true;
+		} else if (strncmp(argv[0], "--readahead=", 12) == 0) {
+			prefetch_depth = atoi(argv[0] + 12);
+		} else if (strncmp(argv[0], "--exclude=", 10) == 0) {
+			ignore_add_pattern(argv[0] + 10);
+		} else if (strncmp(argv[0], "--max-size=", 11) == 0) {
+			ignore_max_size = atol(argv[0] + 11);
+		} else if (strcmp(argv[0], "--no-sniff") == 0) {
+			ignore_sniff = false;
+		} else if (strcmp(argv[0], "--stats") == 0) {
+			stats = true;
+		} else if (strncmp(argv[0], "--files-from=", 13) == 0) {
+			source = argv[0] + 13;
+		} else {
+			printf("Error. Unknown option %s\n", argv[0]);
+			return 1;
+		}
+		++argv, --argc;
+	}
+
+	ignore_load_file(IGNORE_FILE);
+
+	if (worker && argc == 0) {
+		/* stdout is kept for replies */
+		log_stream = stderr;
+		cache_enabled = true;
+		result = worker_run(stdin, stdout, pdf);
+		cache_free();
+		memo_free();
+		prefetch_free();
+		diagnostic_free();
+		ignore_free();
+		yylex_destroy();
+		return result;
+	}
+
+	if (source != NULL && argc <= 1 && !worker) {
+		/* list of modules */
+		outname = text_copy(argc ? argv[0] : STDIO_NAME);
+	} else if (argc == 1 && strcmp(argv[0], STDIO_NAME) == 0 && !worker) {
+		outname = text_copy(STDIO_NAME);
+	} else if (argc == 1 && !worker) {
+		/* make output filename */
+		char* ptr = strrchr(argv[0], '.');
+		int len = ptr ? (int)(ptr - argv[0]) : (int)strlen(argv[0]);
+		const char* ext = "-doc.tex";
+		outname = malloc(len + strlen(ext) + 1);
+		strncpy(outname, argv[0], len);
+		strcpy(outname + len, ext);
+	} else if (argc == 2 && !worker) {
+		outname = text_copy(argv[1]);
+	} else {
+		/* error */
+		printf("Error. Format: ./ccdoc.exe [options] {source file .h|.c|.y|-} {{destination file .tex|-}}\n"
+			"       ./ccdoc.exe [options] --files-from={list file|-} {{destination file .tex|-}}\n"
+			"       ./ccdoc.exe [options] --worker\n"
+			"Options: --pdf --readahead=N --exclude=GLOB --max-size=BYTES --no-sniff --stats\n");
+		return 1;
+	}
+
+	if (strcmp(outname, STDIO_NAME) == 0) {
+		/* stdout belongs to the document */
+		log_stream = stderr;
+		if (pdf) {
+			fprintf(stderr, "Error. --pdf needs a destination file\n");
+			free(outname);
+			return 1;
+		}
+	}
+
+	if (source != NULL) {
+		files = strcmp(source, STDIO_NAME) == 0 ? stdin : fopen(source, "rb");
+		if (files == NULL) {
+			fprintf(log_stream, "I/O error: Can't open list of files\n");
+			free(outname);
+			return 2;
+		}
+	} else {
+		source = argv[0];
+	}
+
+	start = stats_now();
+	result = document_generate(source, files, outname, pdf);
+	if (stats) stats_report(stderr, stats_now() - start);
+	if (files != NULL && files != stdin) fclose(files);
+	free(outname);
+	memo_free();
+	prefetch_free();
+	diagnostic_free();
+	ignore_free();
 
 	yylex_destroy();
-	if(!error_code) return error_code;
-	return 0;
+
+	/* 2 I/O error, 3 errors in modules, 4 pdflatex failed */
+	return result;
 } 
   
 
-int yyerror(char* message) { 
-	fprintf(stderr, "\nError: It's invalid, line %d: %s\n", yylineno, message); 
-	fprintf(stderr, "text: %s\n\n", yytext);
+int yyerror(const char* message) { 
+	char* text = yytext ? yytext : "";
+	size_t length = strcspn(text, "\n");
+	char* reason;
+
+	/* the parsing goes on, the error is reported with the other ones in the end */
+	if (length > 40) length = 40;
+	reason = malloc(strlen(message) + length + 32);
+	if (yychar == 0) {
+		sprintf(reason, "%s, unexpected end of module", message);
+	} else {
+		sprintf(reason, "%s near \"%.*s\"", message, (int)length, text);
+	}
+	diagnostic_add(current_filename, token_offset, reason);
+	free(reason);
 	return 0;
 }
-
-
@@ -5,10 +5,18 @@
 #include "text.h"
 #include "func_param.h"
 #include "comment_block.h"
+#include "location.h"
+#include "cache.h"
+#include "prefetch.h"
+#include "stats.h"
+#include "memo.h"
+#include "diagnostic.h"
+#include "ignore.h"
 
 extern comment_t comment_block;
 extern list_t* includes;
 extern char* current_directory;
+extern char* current_filename;
 extern int error_code;
 extern int yyparse (void);
 
@@ -20,39 +28,125 @@ void put_in_tex(char* text) {
 
 
 void module_parse_file(char* filename) {
-	printf("Parsing: %s\n", filename); 
+	FILE* outfile = NULL;
+	char* source;
+	size_t length;
+	unsigned long hash = 0;
+	double start;
+	double load;
+	int result;
+	int diagnostics;
+	char* reason;
+
+	fprintf(log_stream, "Parsing: %s\n", filename); 
+
+	/* the whole module is loaded at once, the scanner works on this buffer */
+	start = stats_now();
+	if (strcmp(filename, STDIO_NAME) == 0) {
+		/* a pipe can't be checked ahead */
+		source = text_read_stream(stdin, &length);
+	} else {
+		switch (prefetch_take(filename, &source, &length, &reason)) {
+		case PREFETCH_MISSING:
+			/* error */
+			fprintf(log_stream, "Parsing error: can't open file %s\n\n", filename);
+			return;
+		case PREFETCH_SKIPPED:
+			fprintf(log_stream, "Parsing skipped, %s is %s\n\n", filename, reason);
+			return;
+		}
+	}
+	load = stats_now() - start;
+	prefetch_account(load, length);
+	stats_phase[STATS_LOAD] += load;
+	stats_bytes += (long)length;
+
+	if (cache_enabled) {
+		hash = text_hash(source, length);
+		if (cache_emit(filename, hash)) {
+			fprintf(log_stream, "Parsing skipped, %s is cached\n\n", filename);
+			free(source);
+			return;
+		}
+	}
 
 	/* set current directory */
 	current_directory = text_current_directory(filename);
 
-	yyin = fopen(filename, "r");
-	if (yyin == NULL)  {
-		/* error */
-		free(current_directory);
-		printf("Parsing error: can't open file %s\n\n", filename);
-		return;
+	/* the fragment is rendered aside to be cached */
+	if (cache_enabled) {
+		outfile = yyout;
+		yyout = tmpfile();
+		if (yyout == NULL) {
+			yyout = outfile;
+			outfile = NULL;
+		}
 	}
 
+	/* nothing may be left from the previous module */
+	current_filename = filename;
+	diagnostics = diagnostic_count;
+	location_reset(source, (long)length);
+	scanner_reset(source, length);
+	clear_comment_block(&comment_block);
+
 	fprintf(yyout, "\\subsection{Modul \\texttt{%s}}\n", filename);
 
-	if(!yyparse()) {
-		printf("Parsing complete %s\n\n", filename); 
+	start = stats_now();
+	result = yyparse();
+	stats_phase[STATS_PARSE] += stats_now() - start;
+	if(!result && diagnostics == diagnostic_count) {
+		fprintf(log_stream, "Parsing complete %s\n\n", filename); 
+	} else if (!result) {
+		fprintf(log_stream, "Parsing recovered from %d errors %s\n\n",
+			diagnostic_count - diagnostics, filename); 
+		error_code = 3;
 	} else {
-		printf("Parsing failed %s\n\n", filename); 
+		fprintf(log_stream, "Parsing failed %s\n\n", filename); 
 		error_code = 3;
 	}
 
-	fclose(yyin);
+	if (outfile != NULL) {
+		/* a module with errors is parsed again to report them */
+		cache_store(filename, hash, yyout, outfile, result == 0 && diagnostics == diagnostic_count);
+		fclose(yyout);
+		yyout = outfile;
+	}
+
+	location_reset(NULL, 0);
+	free(source);
+	current_filename = NULL;
 
 	if (current_directory != NULL) {
 		free(current_directory);
 	}
+	current_directory = NULL;
+}
+
+
+bool module_queue(char* filename) {
+	if (ignore_path(filename)) {
+		fprintf(log_stream, "parser: IGNORE MODULE %s\n", filename);
+		return false;
+	}
+	cache_add_dependency(filename);
+	if (includes == NULL) {
+		includes = list_new(filename);
+		return true;
+	}
+	return list_add_unique(includes, filename, (bool(*)(void*,void*))text_equal_func);
 }
 
 
 void process_variable(comment_t* block, FILE* outfile, char* variable) {
 	fprintf(outfile, "\\subsubsection {Proměnná \\texttt{%s}}\n", variable);
 
+	if (memo_emit(MEMO_VARIABLE, outfile)) {
+		free_comment_block(block);
+		return;
+	}
+	outfile = memo_begin(outfile);
+
 	if (block->brief) {
 	fprintf(outfile, "\\par\\noindent\n\\textbf {Brief:} %s\\\n",
 		comment_block.brief);
@@ -95,12 +189,21 @@ void process_variable(comment_t* block, FILE* outfile, char* variable) {
 		free(p->description);
 		free(p);
 	}
+
+	clear_comment_block(block);
+	memo_end(outfile);
 }
 
 
 void process_struct(comment_t* block, FILE* outfile, char* struc) {
 	fprintf(outfile, "\\subsubsection {Struktura \\texttt{%s}}\n", struc);
 
+	if (memo_emit(MEMO_STRUCT, outfile)) {
+		free_comment_block(block);
+		return;
+	}
+	outfile = memo_begin(outfile);
+
 	if (block->brief) {
 		fprintf(outfile, "\\par\\noindent\n\\textbf {Brief:} %s\\\n",
 		comment_block.brief); 
@@ -144,6 +247,9 @@ void process_struct(comment_t* block, FILE* outfile, char* struc) {
 			block->version_tag);
 		free(block->version_tag);
 	}
+
+	clear_comment_block(block);
+	memo_end(outfile);
 }
 
 
@@ -170,6 +276,12 @@ void process_function(comment_t* block, FILE* outfile, char* func) {
 	}
 	fprintf(outfile, "%s}}", ptr);
 
+	if (memo_emit(MEMO_FUNCTION, outfile)) {
+		free_comment_block(block);
+		return;
+	}
+	outfile = memo_begin(outfile);
+
 
 	if (block->brief) {
 		fprintf(outfile, "\\par\\noindent\n\\textbf {Brief:} %s\\\\\n",
@@ -218,6 +330,24 @@ void process_function(comment_t* block, FILE* outfile, char* func) {
 			block->version_tag);
 		free(block->version_tag);
 	}
+
+	clear_comment_block(block);
+	memo_end(outfile);
+}
+
+
+void free_comment_block(comment_t* block) {
+	if (block->brief) free(block->brief);
+	if (block->author_tag) free(block->author_tag);
+	if (block->version_tag) free(block->version_tag);
+	if (block->return_tag) {
+		free(block->return_tag->type);
+		free(block->return_tag->description);
+		free(block->return_tag);
+	}
+	if (block->params) list_free(block->params, (void(*)(void*))func_param_free);
+	if (block->details) list_free(block->details, free);
+	clear_comment_block(block);
 }
 
 
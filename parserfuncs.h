@@ -7,6 +7,9 @@
 #ifndef PARSER_FUNCS_H
 #define PARSER_FUNCS_H
 
+/* file name of the standard input or output */
+#define STDIO_NAME "-"
+
 #include "list.h"
 #include "func_param.h"
 #include "comment_block.h"
@@ -25,6 +28,12 @@ extern FILE *yyin;
  */
 extern FILE *yyout;
 
+/**
+ * Stream for progress messages.
+ * It's stdout by default, the worker mode moves the messages to stderr to keep stdout for replies.
+ */
+extern FILE *log_stream;
+
 /**
  * External reference to the current lexeme.
  * After calling yylex(), yytext contains the lexeme that was recognized by the lexer.
@@ -38,12 +47,6 @@ extern char *yytext;
  */
 extern int yylex(void);
 
-/**
- * External reference to the current line number.
- * The lexer increments this value as it reads new lines from the input, allowing for better error reporting.
- */
-extern int yylineno;
-
 /**
  * External reference to the function that deallocates any memory allocated by yylex().
  * This should be called when the lexing is complete to avoid memory leaks.
@@ -51,17 +54,44 @@ extern int yylineno;
  */
 extern int yylex_destroy(void);
 
+/**
+ * Reset scanner function
+ *
+ * This function makes the lexer read a new input from the beginning in the initial start condition.
+ * Nothing scanned from the previous input is kept. The input is scanned in place without copying,
+ * so it must stay allocated until the parsing ends.
+ *
+ * @param char* buffer The input terminated by two zero bytes (see 'text_read_stream').
+ * @param size_t length The length of the input without the terminating bytes.
+ * @version 1.1.0
+ * @author \textcopyright{} Faiz Suleimanov
+ */
+void scanner_reset(char* buffer, size_t length);
+
+/**
+ * Held character function
+ *
+ * While a token is passed to the parser, the lexer keeps a zero byte in the input just behind it
+ * (at 'scan_offset'). The function returns the byte of the input that was there.
+ *
+ * @return char The byte of the input replaced by the lexer.
+ * @version 1.0.0
+ * @author \textcopyright{} Faiz Suleimanov
+ */
+char scanner_held_char(void);
+
 /**
 * Error function
 *
 * The function starts each time the 'yyparse' function
-* finds an error of parsing
+* finds an error of parsing. The error is added to the diagnostics,
+* the parser recovers and goes on with the next comment.
 *
-* @param char* message Error message
-* @version 1.0.0
+* @param const char* message Error message
+* @version 1.1.0
 * @author \textcopyright{} Faiz Suleimanov
 */
-int yyerror(char* message);
+int yyerror(const char* message);
 
 /**
  * Put text in Tex-file function
@@ -89,6 +119,38 @@ void put_in_tex(char* text);
  */
 void module_parse_file(char* filename);
 
+/**
+ * Generate document
+ *
+ * This function generates the whole LaTeX document for a source file and all modules it includes.
+ * It's used both by a single run of the program and by each request of the worker mode. With 'pdf' set,
+ * the document is compiled into PDF afterwards. If a list of files is given, the modules are read from
+ * it one by one while the document is generated instead of starting with the source file. The output
+ * is flushed after every module, so a reader of a pipe gets each module as soon as it's rendered.
+ *
+ * @param char* source The name of the root source file, STDIO_NAME for the standard input.
+ * @param FILE* files NUL-separated list of modules, or NULL.
+ * @param char* outname The name of the LaTeX file to write, STDIO_NAME for the standard output.
+ * @param bool pdf Whether the PDF has to be built.
+ * @return int 0 on success, 2 on I/O error, 3 if a module failed to parse, 4 if pdflatex failed.
+ * @version 1.1.0
+ * @author \textcopyright{} Faiz Suleimanov
+ */
+int document_generate(char* source, FILE* files, char* outname, bool pdf);
+
+/**
+ * Queue module function
+ *
+ * This function adds a module to the list of files to parse unless it matches an ignore rule or
+ * it's already queued. The module is recorded as a dependency of the parsed module for the cache.
+ *
+ * @param char* filename The full name of the module.
+ * @return bool Result (1(true) - the list took the filename, 0(false) - the caller keeps it).
+ * @version 1.0.0
+ * @author \textcopyright{} Faiz Suleimanov
+ */
+bool module_queue(char* filename);
+
 /**
  * Clear Comment Block
  *
@@ -101,6 +163,18 @@ void module_parse_file(char* filename);
  */
 void clear_comment_block(comment_t* block);
 
+/**
+ * Free Comment Block
+ *
+ * This function releases all data of a comment block which wasn't rendered and clears the block
+ * (see 'clear_comment_block').
+ * 
+ * @param comment_t* block The comment block to be freed.
+ * @version 1.0.0 
+ * @author \textcopyright{} Faiz Suleimanov 
+ */
+void free_comment_block(comment_t* block);
+
 /**
  * Process param of a function
  *
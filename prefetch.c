@@ -0,0 +1,332 @@
+#if !defined(_MSC_VER)
+#define _POSIX_C_SOURCE 200112L
+#include <pthread.h>
+#define PREFETCH_THREADS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "prefetch.h"
+#include "text.h"
+#include "ignore.h"
+#include "parserfuncs.h"
+
+int prefetch_depth = PREFETCH_DEPTH;
+
+/**
+ * The furthest node of the list passed to the reader
+ */
+static list_node_t* prefetch_tail = NULL;
+
+/**
+ * Metrics of the current list
+ */
+static int prefetch_calls = 0;
+static long prefetch_queued = 0;
+static int prefetch_max_queued = 0;
+static int prefetch_loaded = 0;
+static int prefetch_ahead = 0;
+static size_t prefetch_bytes = 0;
+static double prefetch_stall = 0;
+static double prefetch_max_stall = 0;
+
+
+/**
+ * Read module function
+ *
+ * The function opens and reads one module, it's used by the reader thread as well.
+ *
+ * @param char* filename The name of the module.
+ * @param char** source Pointer where the content is stored.
+ * @param size_t* length Pointer where the length of the content is stored.
+ * @param char** reason Pointer where the reason of skipping is stored.
+ * @return int Result (PREFETCH_LOADED, PREFETCH_MISSING or PREFETCH_SKIPPED).
+ */
+static int prefetch_read(char* filename, char** source, size_t* length, char** reason) {
+	FILE* f;
+
+	*source = NULL;
+	*length = 0;
+
+	f = fopen(filename, "r");
+	if (f == NULL) return PREFETCH_MISSING;
+
+	if (ignore_stream(f, reason)) {
+		fclose(f);
+		return PREFETCH_SKIPPED;
+	}
+	*source = text_read_stream(f, length);
+	fclose(f);
+	return PREFETCH_LOADED;
+}
+
+
+#if defined(PREFETCH_THREADS)
+
+/*
+ * States of a module passed to the reader
+ */
+#define PREFETCH_QUEUED 0
+#define PREFETCH_READING 1
+#define PREFETCH_DONE 2
+
+/**
+ * Struct prefetch_item_t
+ *
+ * One module passed to the reader thread. The result fields are set when the state is PREFETCH_DONE.
+ * A dropped module is no longer in the queue, the reader releases it when it's read.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+typedef struct prefetch_item_t {
+	struct prefetch_item_t* next;
+	char* filename;
+	int state;
+	bool dropped;
+	int result;
+	char* source;
+	size_t length;
+	char* reason;
+} prefetch_item_t;
+
+/**
+ * Queue of the modules passed to the reader, in the order of the list
+ */
+static prefetch_item_t* prefetch_first = NULL;
+static prefetch_item_t* prefetch_last = NULL;
+
+/**
+ * State of the reader thread, everything above is guarded by the mutex
+ */
+static pthread_t prefetch_thread;
+static pthread_mutex_t prefetch_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t prefetch_work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t prefetch_done = PTHREAD_COND_INITIALIZER;
+static bool prefetch_started = false;
+static bool prefetch_stop = false;
+
+
+static void prefetch_item_free(prefetch_item_t* item) {
+	if (item->source != NULL) free(item->source);
+	free(item->filename);
+	free(item);
+}
+
+
+/**
+ * Drop module function, the mutex has to be locked
+ */
+static void prefetch_drop(prefetch_item_t* item) {
+	if (item->state == PREFETCH_READING) {
+		item->dropped = true;
+	} else {
+		prefetch_item_free(item);
+	}
+}
+
+
+/**
+ * Reader thread, it reads the queued modules one by one
+ */
+static void* prefetch_reader(void* arg) {
+	prefetch_item_t* item;
+	char* source;
+	size_t length;
+	char* reason = NULL;
+	int result;
+
+	(void)arg;
+	pthread_mutex_lock(&prefetch_mutex);
+	while (!prefetch_stop) {
+		for (item = prefetch_first; item != NULL && item->state != PREFETCH_QUEUED; item = item->next);
+		if (item == NULL) {
+			pthread_cond_wait(&prefetch_work, &prefetch_mutex);
+			continue;
+		}
+
+		/* the parser goes on while the module is read */
+		item->state = PREFETCH_READING;
+		pthread_mutex_unlock(&prefetch_mutex);
+		result = prefetch_read(item->filename, &source, &length, &reason);
+		pthread_mutex_lock(&prefetch_mutex);
+
+		item->result = result;
+		item->source = source;
+		item->length = length;
+		item->reason = reason;
+		item->state = PREFETCH_DONE;
+		if (item->dropped) {
+			prefetch_item_free(item);
+		}
+		pthread_cond_broadcast(&prefetch_done);
+	}
+	pthread_mutex_unlock(&prefetch_mutex);
+	return NULL;
+}
+
+
+/**
+ * Pass a module to the reader, the mutex has to be locked
+ */
+static void prefetch_enqueue(char* filename) {
+	prefetch_item_t* item;
+
+	if (!prefetch_started) {
+		prefetch_stop = false;
+		if (pthread_create(&prefetch_thread, NULL, prefetch_reader, NULL) != 0) {
+			/* the modules are read by the parser */
+			prefetch_depth = 0;
+			return;
+		}
+		prefetch_started = true;
+	}
+
+	item = malloc(sizeof(prefetch_item_t));
+	item->next = NULL;
+	item->filename = text_copy(filename);
+	item->state = PREFETCH_QUEUED;
+	item->dropped = false;
+	item->result = PREFETCH_MISSING;
+	item->source = NULL;
+	item->length = 0;
+	item->reason = NULL;
+
+	if (prefetch_last == NULL) {
+		prefetch_first = item;
+	} else {
+		prefetch_last->next = item;
+	}
+	prefetch_last = item;
+	pthread_cond_signal(&prefetch_work);
+}
+
+#endif
+
+
+void prefetch_reset(void) {
+#if defined(PREFETCH_THREADS)
+	pthread_mutex_lock(&prefetch_mutex);
+	while (prefetch_first != NULL) {
+		prefetch_item_t* next = prefetch_first->next;
+		prefetch_drop(prefetch_first);
+		prefetch_first = next;
+	}
+	prefetch_last = NULL;
+	pthread_mutex_unlock(&prefetch_mutex);
+#endif
+
+	prefetch_tail = NULL;
+	prefetch_calls = 0;
+	prefetch_queued = 0;
+	prefetch_max_queued = 0;
+	prefetch_loaded = 0;
+	prefetch_ahead = 0;
+	prefetch_bytes = 0;
+	prefetch_stall = 0;
+	prefetch_max_stall = 0;
+}
+
+
+void prefetch_modules(list_node_t* current) {
+	list_node_t* p;
+	int queued = 0;
+	int skip = prefetch_tail != NULL && prefetch_tail != current;
+
+#if defined(PREFETCH_THREADS)
+	pthread_mutex_lock(&prefetch_mutex);
+#endif
+	for (p = current->next; p != NULL && queued < prefetch_depth; p = p->next, queued++) {
+		if (skip) {
+			/* already in flight */
+			skip = p != prefetch_tail;
+			continue;
+		}
+#if defined(PREFETCH_THREADS)
+		/* the standard input is read by the parser */
+		if (strcmp(p->value, STDIO_NAME) != 0) prefetch_enqueue(p->value);
+#endif
+		prefetch_tail = p;
+	}
+#if defined(PREFETCH_THREADS)
+	pthread_mutex_unlock(&prefetch_mutex);
+#endif
+
+	prefetch_calls++;
+	prefetch_queued += queued;
+	if (queued > prefetch_max_queued) prefetch_max_queued = queued;
+}
+
+
+int prefetch_take(char* filename, char** source, size_t* length, char** reason) {
+#if defined(PREFETCH_THREADS)
+	prefetch_item_t* item;
+	int result;
+
+	pthread_mutex_lock(&prefetch_mutex);
+	for (item = prefetch_first; item != NULL && strcmp(item->filename, filename) != 0; item = item->next);
+
+	if (item != NULL) {
+		/* the modules are taken in the order of the list, the ones before it won't be */
+		while (prefetch_first != item) {
+			prefetch_item_t* next = prefetch_first->next;
+			prefetch_drop(prefetch_first);
+			prefetch_first = next;
+		}
+
+		while (item->state != PREFETCH_DONE) {
+			pthread_cond_wait(&prefetch_done, &prefetch_mutex);
+		}
+
+		prefetch_first = item->next;
+		if (prefetch_first == NULL) prefetch_last = NULL;
+		pthread_mutex_unlock(&prefetch_mutex);
+
+		result = item->result;
+		*source = item->source;
+		*length = item->length;
+		*reason = item->reason;
+		item->source = NULL;
+		prefetch_item_free(item);
+		prefetch_ahead++;
+		return result;
+	}
+	pthread_mutex_unlock(&prefetch_mutex);
+#endif
+
+	return prefetch_read(filename, source, length, reason);
+}
+
+
+void prefetch_account(double stall, size_t length) {
+	prefetch_loaded++;
+	prefetch_bytes += length;
+	prefetch_stall += stall;
+	if (stall > prefetch_max_stall) prefetch_max_stall = stall;
+}
+
+
+void prefetch_report(FILE* stream) {
+	fprintf(stream, "Read-ahead: depth %d, in flight %.2f avg %d max, "
+		"loaded %d modules (%lu bytes, %d read ahead), stall %.3f ms total %.3f ms max\n",
+		prefetch_depth, prefetch_calls ? (double)prefetch_queued / prefetch_calls : 0.0,
+		prefetch_max_queued, prefetch_loaded, (unsigned long)prefetch_bytes, prefetch_ahead,
+		prefetch_stall * 1000, prefetch_max_stall * 1000);
+}
+
+
+void prefetch_free(void) {
+	prefetch_reset();
+#if defined(PREFETCH_THREADS)
+	if (!prefetch_started) return;
+
+	pthread_mutex_lock(&prefetch_mutex);
+	prefetch_stop = true;
+	pthread_cond_signal(&prefetch_work);
+	pthread_mutex_unlock(&prefetch_mutex);
+
+	pthread_join(prefetch_thread, NULL);
+	prefetch_started = false;
+#endif
+}
@@ -0,0 +1,104 @@
+#ifndef PREFETCH_H
+#define PREFETCH_H
+
+#include <stdio.h>
+#include "list.h"
+
+/*
+ * Default count of modules read ahead
+ */
+#define PREFETCH_DEPTH 4
+
+/*
+ * Results of loading a module
+ */
+#define PREFETCH_LOADED 0
+#define PREFETCH_MISSING 1
+#define PREFETCH_SKIPPED 2
+
+/**
+ * Read-ahead depth variable
+ *
+ * Count of queued modules whose loading is started before they are parsed, 0 disables it.
+ */
+extern int prefetch_depth;
+
+/**
+ * Reset read-ahead function
+ *
+ * The function drops the modules read ahead for the previous list and clears the metrics.
+ * It has to be called before a new list of modules is processed.
+ *
+ * @version 1.1.0
+ * @author Faiz Suleimanov
+ */
+void prefetch_reset(void);
+
+/**
+ * Read ahead function
+ *
+ * The function passes the next modules of the list to a reader thread, which opens and reads
+ * them while the current module is parsed. Modules which were already passed are skipped.
+ * Where threads aren't available (the MSVC build), only the metrics are collected and every
+ * module is read when it's taken.
+ *
+ * @param list_node_t* current The node of the module which is going to be parsed.
+ * @version 1.1.0
+ * @author Faiz Suleimanov
+ */
+void prefetch_modules(list_node_t* current);
+
+/**
+ * Take module function
+ *
+ * The function gives the content of a module to the parser. A module read ahead is taken from
+ * the reader thread, waiting for it if the reading isn't finished yet. Other modules are read
+ * right away. Modules with a "generated file" marker or over the size limit are skipped
+ * (see 'ignore_stream').
+ *
+ * @param char* filename The name of the module.
+ * @param char** source Pointer where the content is stored, it ends with two zero bytes.
+ * @param size_t* length Pointer where the length of the content is stored.
+ * @param char** reason Pointer where the reason of skipping is stored.
+ * @return int Result (PREFETCH_LOADED, PREFETCH_MISSING or PREFETCH_SKIPPED).
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+int prefetch_take(char* filename, char** source, size_t* length, char** reason);
+
+/**
+ * Account load function
+ *
+ * The function records how long the parser waited for a module to be read.
+ *
+ * @param double stall Time spent waiting for the module in seconds.
+ * @param size_t length Count of read bytes.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void prefetch_account(double stall, size_t length);
+
+/**
+ * Report function
+ *
+ * The function prints the read-ahead metrics: configured depth, average and maximal count of
+ * modules in flight, how many modules came from the reader thread, and the total and maximal
+ * stall time.
+ *
+ * @param FILE* stream The stream to print to.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void prefetch_report(FILE* stream);
+
+/**
+ * Free read-ahead function
+ *
+ * The function stops the reader thread and releases the modules which weren't taken.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void prefetch_free(void);
+
+#endif
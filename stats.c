@@ -0,0 +1,63 @@
+#if !defined(_MSC_VER)
+#define _XOPEN_SOURCE 600
+#include <sys/resource.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+#include "stats.h"
+
+double stats_phase[STATS_PHASES];
+long stats_tokens = 0;
+long stats_bytes = 0;
+
+
+double stats_now(void) {
+#if defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+		return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+	}
+#endif
+	return (double)clock() / CLOCKS_PER_SEC;
+}
+
+
+void stats_reset(void) {
+	int i;
+	for (i = 0; i < STATS_PHASES; i++) {
+		stats_phase[i] = 0;
+	}
+	stats_tokens = 0;
+	stats_bytes = 0;
+}
+
+
+long stats_peak_rss(void) {
+#if defined(RUSAGE_SELF)
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+		return usage.ru_maxrss / 1024; /* bytes on macOS */
+#else
+		return usage.ru_maxrss;
+#endif
+	}
+#endif
+	return 0;
+}
+
+
+void stats_report(FILE* stream, double wall) {
+	double other = wall - stats_phase[STATS_LOAD] - stats_phase[STATS_PARSE] - stats_phase[STATS_PDF];
+
+	fprintf(stream, "stats wall_ms %.3f\n", wall * 1000);
+	fprintf(stream, "stats load_ms %.3f\n", stats_phase[STATS_LOAD] * 1000);
+	fprintf(stream, "stats parse_ms %.3f\n", stats_phase[STATS_PARSE] * 1000);
+	fprintf(stream, "stats pdf_ms %.3f\n", stats_phase[STATS_PDF] * 1000);
+	fprintf(stream, "stats other_ms %.3f\n", (other > 0 ? other : 0) * 1000);
+	fprintf(stream, "stats tokens %ld\n", stats_tokens);
+	fprintf(stream, "stats bytes %ld\n", stats_bytes);
+	fprintf(stream, "stats tokens_per_s %.0f\n", wall > 0 ? stats_tokens / wall : 0.0);
+	fprintf(stream, "stats rss_kb %ld\n", stats_peak_rss());
+}
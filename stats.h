@@ -0,0 +1,77 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+
+/*
+ * Phases of a run measured by the statistics
+ */
+#define STATS_LOAD 0
+#define STATS_PARSE 1
+#define STATS_PDF 2
+#define STATS_PHASES 3
+
+/*
+ * Time spent in each phase of the current document in seconds
+ */
+extern double stats_phase[STATS_PHASES];
+
+/**
+ * Count of tokens passed to the parser for the current document
+ */
+extern long stats_tokens;
+
+/**
+ * Count of bytes loaded for the current document
+ */
+extern long stats_bytes;
+
+/**
+ * Current time function
+ *
+ * The function returns a monotonic wall clock time in seconds. It's used to measure
+ * how long the parts of a run take. Where the monotonic clock isn't available,
+ * the processor time of the program is used instead.
+ *
+ * @return double Time in seconds from an unspecified point
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+double stats_now(void);
+
+/**
+ * Reset statistics function
+ *
+ * The function sets all phase times and counters to 0, it's called for each document.
+ *
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void stats_reset(void);
+
+/**
+ * Peak memory function
+ *
+ * The function asks the operating system for the largest memory use of the process so far.
+ *
+ * @return long Peak resident set size of the process in kilobytes, 0 where it isn't available
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+long stats_peak_rss(void);
+
+/**
+ * Report statistics function
+ *
+ * The function prints the statistics of the last document, one "stats <name> <value>" line each:
+ * wall time, time of the phases (load, parse, pdf and the rest as other) in milliseconds,
+ * tokens, bytes, tokens per second and peak memory. The form is meant to be read by scripts.
+ *
+ * @param FILE* stream The stream to print to.
+ * @param double wall Wall time of the whole document in seconds.
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+void stats_report(FILE* stream, double wall);
+
+#endif
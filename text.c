@@ -13,3 +13,86 @@ char* text_copy(char* s) {
 bool text_equal_func(char* s1, char* s2) {
 	return !strcmp(s1, s2);
 }
+
+
+#define TEXT_HASH_BASIS 2166136261UL
+#define TEXT_HASH_PRIME 16777619UL
+
+static unsigned long text_hash_update(unsigned long hash, char* data, size_t length) {
+	size_t i;
+	for (i = 0; i < length; i++) {
+		hash ^= (unsigned char)data[i];
+		hash = (hash * TEXT_HASH_PRIME) & 0xffffffffUL;
+	}
+	return hash;
+}
+
+
+unsigned long text_hash(char* data, size_t length) {
+	return text_hash_update(TEXT_HASH_BASIS, data, length);
+}
+
+
+bool text_file_hash(char* filename, unsigned long* hash) {
+	FILE* f;
+	char buffer[4096];
+	size_t n;
+	unsigned long h = TEXT_HASH_BASIS;
+
+	f = fopen(filename, "rb");
+	if (f == NULL) return false;
+
+	while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+		h = text_hash_update(h, buffer, n);
+	}
+	fclose(f);
+
+	*hash = h;
+	return true;
+}
+
+
+char* text_read_stream(FILE* stream, size_t* length) {
+	size_t capacity = 4096;
+	size_t n = 0;
+	char* buffer = malloc(capacity + 2);
+
+	for (;;) {
+		n += fread(buffer + n, 1, capacity - n, stream);
+		if (n < capacity) break;
+		capacity *= 2;
+		buffer = realloc(buffer, capacity + 2);
+	}
+	buffer[n] = '\0';
+	buffer[n + 1] = '\0';
+
+	*length = n;
+	return buffer;
+}
+
+
+char* text_read_field(FILE* stream, int delimiter) {
+	size_t capacity = 256;
+	size_t n = 0;
+	char* field = malloc(capacity);
+	int c;
+
+	while ((c = getc(stream)) != EOF) {
+		if (c == delimiter) {
+			if (n > 0) break;
+			continue;
+		}
+		if (n + 1 == capacity) {
+			capacity *= 2;
+			field = realloc(field, capacity);
+		}
+		field[n++] = (char)c;
+	}
+
+	if (n == 0) {
+		free(field);
+		return NULL;
+	}
+	field[n] = '\0';
+	return field;
+}
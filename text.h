@@ -1,6 +1,7 @@
 #ifndef TEXT_H
 #define TEXT_H
 
+#include <stdio.h>
 #include <stdbool.h>
 
 
@@ -29,4 +30,58 @@ char* text_copy(char* s);
  */
 bool text_equal_func(char* s1, char* s2);
 
+/**
+ * Text hash function
+ *
+ * The function computes a 32-bit FNV-1a hash of a memory block
+ *
+ * @param char* data Pointer to the first byte to hash
+ * @param size_t length Count of bytes to hash
+ * @return unsigned long Hash of the block
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+unsigned long text_hash(char* data, size_t length);
+
+/**
+ * File hash function
+ *
+ * The function computes the same hash as 'text_hash' over the whole content of a file
+ *
+ * @param char* filename Name of the file to hash
+ * @param unsigned long* hash Pointer where the hash is stored
+ * @return bool Result (1(true) - file was hashed, 0(false) - file can't be opened)
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+bool text_file_hash(char* filename, unsigned long* hash);
+
+/**
+ * Read stream function
+ *
+ * The function reads the rest of a stream into a newly allocated buffer terminated by two zero bytes,
+ * so the buffer can be scanned in place by the lexer
+ *
+ * @param FILE* stream Stream to read
+ * @param size_t* length Pointer where the count of read bytes is stored
+ * @return char* Pointer to the buffer
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+char* text_read_stream(FILE* stream, size_t* length);
+
+/**
+ * Read field function
+ *
+ * The function reads the next field of a stream separated by a delimiter (like NUL in 'find -print0').
+ * Empty fields are skipped.
+ *
+ * @param FILE* stream Stream to read
+ * @param int delimiter Character which ends a field
+ * @return char* Newly allocated C-string with the field, or NULL if the stream ended
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+char* text_read_field(FILE* stream, int delimiter);
+
 #endif
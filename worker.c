@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "worker.h"
+#include "parserfuncs.h"
+#include "cache.h"
+#include "stats.h"
+#include "diagnostic.h"
+
+/*
+ * Maximal size of a request, anything longer is a broken stream
+ */
+#define WORKER_MAX_REQUEST 65536UL
+
+
+/**
+ * Read the length prefix of a message
+ *
+ * The length is stored in 4 bytes, the most significant byte first.
+ *
+ * @return bool Result (1(true) - read, 0(false) - the stream ended)
+ */
+static bool worker_read_length(FILE* in, unsigned long* length) {
+	unsigned char prefix[4];
+
+	if (fread(prefix, 1, 4, in) != 4) return false;
+	*length = ((unsigned long)prefix[0] << 24) | ((unsigned long)prefix[1] << 16)
+		| ((unsigned long)prefix[2] << 8) | (unsigned long)prefix[3];
+	return true;
+}
+
+
+static void worker_reply(FILE* out, char* message) {
+	unsigned long length = strlen(message);
+	unsigned char prefix[4];
+
+	prefix[0] = (unsigned char)(length >> 24);
+	prefix[1] = (unsigned char)(length >> 16);
+	prefix[2] = (unsigned char)(length >> 8);
+	prefix[3] = (unsigned char)length;
+	fwrite(prefix, 1, 4, out);
+	fwrite(message, 1, length, out);
+	fflush(out);
+}
+
+
+/**
+ * Process one request
+ *
+ * The fields of the request are checked and the document is generated.
+ *
+ * @return int Status of the request
+ */
+static int worker_process(char* request, unsigned long length, bool pdf) {
+	char* fields[2];
+	char* p = request;
+	char* end = request + length;
+	int count = 0;
+
+	for (; p < end; p += strlen(p) + 1) {
+		if (count < 2) {
+			fields[count++] = p;
+		} else if (strcmp(p, "--pdf") == 0) {
+			pdf = true;
+		} else if (strcmp(p, "--no-pdf") == 0) {
+			pdf = false;
+		} else {
+			fprintf(log_stream, "Worker error: unknown option %s\n", p);
+			return 1;
+		}
+	}
+
+	if (count < 2) {
+		fprintf(log_stream, "Worker error: request needs a source and a destination file\n");
+		return 1;
+	}
+
+	/* the standard streams belong to the protocol */
+	if (strcmp(fields[0], STDIO_NAME) == 0 || strcmp(fields[1], STDIO_NAME) == 0) {
+		fprintf(log_stream, "Worker error: %s can't be used in a request\n", STDIO_NAME);
+		return 1;
+	}
+
+	return document_generate(fields[0], NULL, fields[1], pdf);
+}
+
+
+int worker_run(FILE* in, FILE* out, bool pdf) {
+	unsigned long length;
+
+	while (worker_read_length(in, &length) && length > 0) {
+		char reply[128];
+		char* request;
+		double start;
+		int status;
+
+		if (length > WORKER_MAX_REQUEST) {
+			fprintf(log_stream, "Worker error: request of %lu bytes is too long\n", length);
+			return 2;
+		}
+
+		/* the last field needs its terminating zero as well */
+		request = malloc(length + 1);
+		if (fread(request, 1, length, in) != length) {
+			free(request);
+			fprintf(log_stream, "Worker error: truncated request\n");
+			return 2;
+		}
+		request[length] = '\0';
+
+		cache_reset_counters();
+		start = stats_now();
+		status = worker_process(request, length, pdf);
+
+		sprintf(reply, "status=%d time=%.6f modules=%d cached=%d diagnostics=%d\n",
+			status, stats_now() - start, cache_hits + cache_misses, cache_hits, diagnostic_count);
+		worker_reply(out, reply);
+		free(request);
+	}
+	return 0;
+}
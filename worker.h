@@ -0,0 +1,27 @@
+#ifndef WORKER_H
+#define WORKER_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+/**
+ * Worker loop function
+ *
+ * This function serves requests of a build system until the input is closed or an empty request comes.
+ * Every request and reply is a message prefixed by its length (4 bytes, big-endian). A request consists of
+ * zero-terminated fields: the root source file, the destination LaTeX file and any count of options
+ * ('--pdf' or '--no-pdf'). Each request is processed by 'document_generate', and the reply is a text line
+ * "status=<code> time=<seconds> modules=<count> cached=<count>
+ * diagnostics=<count>". Modules stay cached between requests
+ * while their content hash doesn't change.
+ *
+ * @param FILE* in The stream requests are read from.
+ * @param FILE* out The stream replies are written to.
+ * @param bool pdf Whether the PDF is built when a request doesn't say otherwise.
+ * @return int Result (0 - the input was closed properly, 2 - a truncated request).
+ * @version 1.0.0
+ * @author Faiz Suleimanov
+ */
+int worker_run(FILE* in, FILE* out, bool pdf);
+
+#endif